@@ -105,6 +105,10 @@ StompCrushAudioProcessorEditor::StompCrushAudioProcessorEditor (StompCrushAudioP
     addAndMakeVisible (octaveBox);
     octAtt = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(apvts, "octaveMode", octaveBox);
 
+    chainBox.addItemList (apvts.getParameter ("chainOrder")->getAllValueStrings(), 1);
+    addAndMakeVisible (chainBox);
+    chainAtt = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(apvts, "chainOrder", chainBox);
+
     // Preset menu (GUI-only) — moved to top-right, no label
     presetBox.addItem ("Init",       1);
     presetBox.addItem ("Warm Fuzz",  2);
@@ -162,6 +166,7 @@ void StompCrushAudioProcessorEditor::paint (juce::Graphics& g)
     knobLabel ("Mix",        wetSlider);
     knobLabel ("Trim",       trimSlider);
     knobLabel ("Sustain",    sustainSlider);
+    knobLabel ("Order",      chainBox);
 
     // (Preset label removed; dropdown alone in top-right)
 }
@@ -189,6 +194,7 @@ void StompCrushAudioProcessorEditor::resized()
 
     int comboW = int (D * 1.2f), comboH = int (D * 0.5f);
     octaveBox.setBounds (int(0.5f * W - comboW/2), int(0.86f * H - comboH/2), comboW, comboH);
+    chainBox.setBounds  (int(0.8f * W - comboW/2), int(0.70f * H - comboH/2), comboW, comboH);
 
     // Preset menu top-right (no label)
     int presetW = int(comboW * 1.2f), presetH = comboH;
@@ -219,6 +225,10 @@ void StompCrushAudioProcessorEditor::applyPreset (int id)
         processor.apvts.getParameterAsValue ("octaveMode") = index0Based;
     };
 
+    // Presets were voiced on the classic chain
+    if (id > 1)
+        processor.apvts.getParameterAsValue ("chainOrder") = 0;
+
     switch (id)
     {
         case 2: // Warm Fuzz
@@ -32,11 +32,11 @@ private:
 
     // Controls
     juce::Slider gainSlider, bitSlider, dsSlider, cutoffSlider, wetSlider, trimSlider, sustainSlider;
-    juce::ComboBox octaveBox, presetBox;
+    juce::ComboBox octaveBox, chainBox, presetBox;
 
     // Attachments
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> gainAtt, bitAtt, dsAtt, cutoffAtt, wetAtt, trimAtt, sustainAtt;
-    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> octAtt;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> octAtt, chainAtt;
 
     void placeKnob(juce::Component& c, float cx, float cy, int d);
     void drawOutlinedText (juce::Graphics& g, const juce::String& text, juce::Rectangle<int> area,
@@ -4,6 +4,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include <juce_gui_basics/juce_gui_basics.h>
+#include "StageChain.h"
 
 class StompCrushAudioProcessor  : public juce::AudioProcessor
 {
@@ -51,27 +52,18 @@ private:
     static constexpr auto PID_TRIM_DB    = "outTrimDb";
     static constexpr auto PID_SUSTAIN    = "sustain";
     static constexpr auto PID_BYPASS     = "bypass";
+    static constexpr auto PID_CHAIN      = "chainOrder";
 
-    // DSP
-    juce::dsp::Compressor<float> compressor;
-    juce::dsp::StateVariableTPTFilter<float> lowpass;
+    // DSP (stage order picked per block from chainOrders)
+    StageRack stages;
     juce::dsp::ProcessSpec spec {};
 
-    std::vector<int>   dsCounters;
-    std::vector<float> dsHold;
-
-    struct OctState { float lastSample = 0.0f; int zeroCrossCount = 0; int flip = 1; float env = 0.0f; };
-    std::vector<OctState> oct;
-
     juce::AudioBuffer<float> dryBuffer;
     juce::AudioParameterBool* bypassParam = nullptr;
 
     static juce::AudioProcessorValueTreeState::ParameterLayout createLayout();
     static inline float dbToGain (float db) { return juce::Decibels::decibelsToGain (db); }
 
-    float lightSaturate (float x) noexcept;
-    float crushSample (float x, int bits) noexcept;
-
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StompCrushAudioProcessor)
 };
 
@@ -0,0 +1,220 @@
+//EgoA DSP FX Papa's Fuzz Ball
+//Daniel Allen Rinker 2025 daniel.rinker@protonmail.ch
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+// Each stage is a plain type with a non-virtual process(). Block-rate settings
+// are written into the stage before the chain runs; per-sample loops stay inside
+// the stage so the compiler sees the whole inner loop.
+
+struct GainStage
+{
+    float linGain = 1.0f;
+
+    void prepare (const juce::dsp::ProcessSpec&) {}
+    void process (juce::AudioBuffer<float>& buffer) noexcept
+    {
+        buffer.applyGain (linGain);
+    }
+};
+
+struct SaturateStage
+{
+    void prepare (const juce::dsp::ProcessSpec&) {}
+
+    static inline float lightSaturate (float x) noexcept
+    {
+        const float drive = 1.7f;
+        const float y = std::tanh (drive * x);
+        const float makeup = 1.15f;
+        return makeup * y;
+    }
+
+    void process (juce::AudioBuffer<float>& buffer) noexcept
+    {
+        const int numSmps = buffer.getNumSamples();
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer (ch);
+            for (int i = 0; i < numSmps; ++i)
+                data[i] = lightSaturate (data[i]);
+        }
+    }
+};
+
+struct CompressStage
+{
+    juce::dsp::Compressor<float> compressor;
+
+    void prepare (const juce::dsp::ProcessSpec& spec)
+    {
+        compressor.reset();
+        compressor.prepare (spec);
+        compressor.setThreshold (-18.0f);
+        compressor.setRatio (3.0f);
+        compressor.setAttack (5.0f);
+        compressor.setRelease (80.0f);
+    }
+
+    void process (juce::AudioBuffer<float>& buffer) noexcept
+    {
+        juce::dsp::AudioBlock<float> block (buffer);
+        juce::dsp::ProcessContextReplacing<float> ctx (block);
+        compressor.process (ctx);
+    }
+};
+
+// Bitcrusher with +6 dB pre-drive and sample-and-hold downsampling
+struct CrushStage
+{
+    int bits = 6;
+    int dsN  = 4;
+
+    std::vector<int>   dsCounters;
+    std::vector<float> dsHold;
+
+    void prepare (const juce::dsp::ProcessSpec& spec) { setNumChannels ((int) spec.numChannels); }
+    void setNumChannels (int numCh)
+    {
+        dsCounters.assign ((size_t) numCh, 0);
+        dsHold.assign ((size_t) numCh, 0.0f);
+    }
+
+    static inline float crushSample (float x, int bits) noexcept
+    {
+        const int maxSteps = (1 << (bits - 1)) - 1;
+        const float clamped = juce::jlimit (-1.0f, 1.0f, x);
+        return std::round (clamped * maxSteps) / (float) maxSteps;
+    }
+
+    void process (juce::AudioBuffer<float>& buffer) noexcept
+    {
+        const float crushDrive = juce::Decibels::decibelsToGain (6.0f);
+        const int numSmps = buffer.getNumSamples();
+
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer (ch);
+            auto& counter = dsCounters[(size_t) ch];
+            auto& hold    = dsHold[(size_t) ch];
+
+            for (int i = 0; i < numSmps; ++i)
+            {
+                if (counter == 0)
+                {
+                    const float driven = data[i] * crushDrive;
+                    hold = crushSample (driven, bits);
+                }
+                data[i] = hold;
+                if (++counter >= dsN) counter = 0;
+            }
+        }
+    }
+};
+
+struct OctaveStage
+{
+    int octMode = 0; // -1=Down, 0=Off, +1=Up
+
+    struct OctState { float lastSample = 0.0f; int zeroCrossCount = 0; int flip = 1; float env = 0.0f; };
+    std::vector<OctState> oct;
+
+    void prepare (const juce::dsp::ProcessSpec& spec) { setNumChannels ((int) spec.numChannels); }
+    void setNumChannels (int numCh) { oct.assign ((size_t) numCh, {}); }
+
+    void process (juce::AudioBuffer<float>& buffer) noexcept
+    {
+        if (octMode == 0)
+            return;
+
+        const int numSmps = buffer.getNumSamples();
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer (ch);
+            auto& st = oct[(size_t) ch];
+
+            for (int i = 0; i < numSmps; ++i)
+            {
+                const float x = data[i];
+
+                if (octMode > 0) // up
+                {
+                    float y = std::abs (x);
+                    y = (2.0f * y) - 1.0f;
+                    data[i] = juce::jlimit (-1.0f, 1.0f, y);
+                }
+                else              // down
+                {
+                    const bool crossed = ((x >= 0.0f && st.lastSample < 0.0f) ||
+                                          (x <  0.0f && st.lastSample >= 0.0f));
+                    if (crossed)
+                    {
+                        st.zeroCrossCount++;
+                        if (st.zeroCrossCount >= 2) { st.flip = -st.flip; st.zeroCrossCount = 0; }
+                    }
+                    st.lastSample = x;
+
+                    const float targetEnv = std::abs (x);
+                    const float atk = 0.01f, rel = 0.001f;
+                    const float coeff = (targetEnv > st.env ? atk : rel);
+                    st.env = (1.0f - coeff) * st.env + coeff * targetEnv;
+
+                    data[i] = juce::jlimit (-1.0f, 1.0f, (float) st.flip * st.env);
+                }
+            }
+        }
+    }
+};
+
+struct LowpassStage
+{
+    juce::dsp::StateVariableTPTFilter<float> lowpass;
+
+    void prepare (const juce::dsp::ProcessSpec& spec)
+    {
+        lowpass.reset();
+        lowpass.setType (juce::dsp::StateVariableTPTFilterType::lowpass);
+        lowpass.prepare (spec);
+    }
+
+    void process (juce::AudioBuffer<float>& buffer) noexcept
+    {
+        juce::dsp::AudioBlock<float> block (buffer);
+        juce::dsp::ProcessContextReplacing<float> ctx (block);
+        lowpass.process (ctx);
+    }
+};
+
+// One instance of every stage; the chain only decides the order they run in.
+using StageRack = std::tuple<GainStage, SaturateStage, CompressStage, CrushStage, OctaveStage, LowpassStage>;
+
+template <typename... Stages>
+struct StageChain
+{
+    static void process (StageRack& rack, juce::AudioBuffer<float>& buffer) noexcept
+    {
+        (std::get<Stages> (rack).process (buffer), ...);
+    }
+};
+
+// Supported orderings. Index matches the "chainOrder" choice parameter, so only append.
+struct ChainOrder
+{
+    const char* name;
+    void (*process) (StageRack&, juce::AudioBuffer<float>&) noexcept;
+};
+
+inline constexpr std::array<ChainOrder, 6> chainOrders
+{{
+    { "Classic",        &StageChain<GainStage, SaturateStage, CompressStage, CrushStage, OctaveStage, LowpassStage>::process },
+    { "Filter > Crush", &StageChain<GainStage, SaturateStage, CompressStage, LowpassStage, CrushStage, OctaveStage>::process },
+    { "Octave First",   &StageChain<GainStage, OctaveStage, SaturateStage, CompressStage, CrushStage, LowpassStage>::process },
+    { "Squash First",   &StageChain<GainStage, CompressStage, SaturateStage, CrushStage, OctaveStage, LowpassStage>::process },
+    { "Crush First",    &StageChain<GainStage, CrushStage, OctaveStage, SaturateStage, CompressStage, LowpassStage>::process },
+    { "Dark Crush",     &StageChain<GainStage, OctaveStage, LowpassStage, SaturateStage, CompressStage, CrushStage>::process },
+}};